@@ -2,8 +2,307 @@
 #include "webflex/core/utils.hpp"
 #include "webflex/application.hpp"
 
+#include <QLoggingCategory>
+#include <QElapsedTimer>
+#include <QJsonDocument>
+#include <QThread>
+#include <QHash>
+
+#include <condition_variable>
+#include <functional>
+#include <algorithm>
+#include <chrono>
+#include <vector>
+#include <thread>
+#include <mutex>
+
 namespace webflex::impl
 {
+    namespace
+    {
+        Q_LOGGING_CATEGORY(lcBridge, "webflex.bridge", QtInfoMsg)
+
+        // GUI-thread budget for a synchronous member, taken from the bridge's
+        // "webflexCallBudget" dynamic property in milliseconds (default 50).
+        std::chrono::milliseconds callBudget(const QObject &bridge)
+        {
+            auto budget = bridge.property("webflexCallBudget").toInt();
+            return std::chrono::milliseconds(budget > 0 ? budget : 50);
+        }
+
+        // Watches members executing on the GUI thread from a thread of its own
+        // and warns once per budget for as long as any of them overruns it,
+        // including outer members that are busy making nested bridge calls.
+        class GuiWatchdog
+        {
+        public:
+            using Clock = std::chrono::steady_clock;
+
+            static GuiWatchdog &instance()
+            {
+                static GuiWatchdog watchdog;
+                return watchdog;
+            }
+
+            void enter(const QString &name, std::chrono::milliseconds budget)
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                auto now = Clock::now();
+                m_calls.push_back({name, now, budget, now + budget});
+
+                // The watchdog only sleeps untimed while nothing runs; otherwise
+                // its timed wait picks the new call up on its own.
+                if (m_calls.size() == 1)
+                {
+                    m_condition.notify_one();
+                }
+            }
+
+            void leave()
+            {
+                Call call;
+                {
+                    std::lock_guard<std::mutex> lock(m_mutex);
+                    call = std::move(m_calls.back());
+                    m_calls.pop_back();
+                }
+
+                auto elapsed = Clock::now() - call.start;
+                if (elapsed > call.budget)
+                {
+                    qCWarning(lcBridge).noquote() << "call" << call.name << "blocked the GUI thread for"
+                                                  << std::chrono::duration_cast<std::chrono::milliseconds>(elapsed).count() << "ms";
+                }
+            }
+
+        private:
+            struct Call
+            {
+                QString name;
+                Clock::time_point start;
+                std::chrono::milliseconds budget;
+                Clock::time_point deadline;
+            };
+
+            GuiWatchdog() : m_thread([this]{ run(); })
+            {
+            }
+
+            ~GuiWatchdog()
+            {
+                {
+                    std::lock_guard<std::mutex> lock(m_mutex);
+                    m_stop = true;
+                }
+                m_condition.notify_one();
+                m_thread.join();
+            }
+
+            void run()
+            {
+                std::unique_lock<std::mutex> lock(m_mutex);
+                while (!m_stop)
+                {
+                    if (m_calls.empty())
+                    {
+                        m_condition.wait(lock);
+                        continue;
+                    }
+
+                    auto deadline = std::min_element(m_calls.begin(), m_calls.end(), [](const Call &lhs, const Call &rhs) {
+                        return lhs.deadline < rhs.deadline;
+                    })->deadline;
+                    m_condition.wait_until(lock, deadline);
+
+                    auto now = Clock::now();
+                    std::vector<std::pair<QString, qint64>> overruns;
+                    for (auto &call : m_calls)
+                    {
+                        if (call.deadline <= now)
+                        {
+                            overruns.emplace_back(call.name, std::chrono::duration_cast<std::chrono::milliseconds>(now - call.start).count());
+                            call.deadline = now + call.budget;
+                        }
+                    }
+
+                    lock.unlock();
+                    for (const auto &[name, elapsed] : overruns)
+                    {
+                        qCWarning(lcBridge).noquote() << "call" << name << "still running on the GUI thread after" << elapsed << "ms";
+                    }
+                    lock.lock();
+                }
+            }
+
+            std::mutex m_mutex;
+            std::condition_variable m_condition;
+            std::vector<Call> m_calls;
+            bool m_stop = false;
+            std::thread m_thread;
+        };
+
+        struct GuiWatchdogScope
+        {
+            GuiWatchdogScope(const QString &name, std::chrono::milliseconds budget)
+            {
+                GuiWatchdog::instance().enter(name, budget);
+            }
+
+            ~GuiWatchdogScope()
+            {
+                GuiWatchdog::instance().leave();
+            }
+        };
+
+        // Compression threshold in bytes for `name`, taken from the bridge's
+        // "webflexCompressMembers" dynamic property (a QVariantMap of member
+        // name to threshold). Members that are not listed return -1.
+        qsizetype compressThreshold(const QObject &bridge, const QString &name)
+        {
+            auto members = bridge.property("webflexCompressMembers").toMap();
+            auto it = members.constFind(name);
+            if (it == members.constEnd())
+            {
+                return -1;
+            }
+
+            bool ok = false;
+            auto threshold = it->toLongLong(&ok);
+            return ok && threshold >= 0 ? threshold : -1;
+        }
+
+        // Whether QJsonDocument carries `value` exactly as QWebChannel would;
+        // anything else (QObject pointers, custom types) must stay uncompressed.
+        bool isJsonSafe(const QVariant &value)
+        {
+            switch (value.typeId())
+            {
+            case QMetaType::UnknownType:
+            case QMetaType::Nullptr:
+            case QMetaType::Bool:
+            case QMetaType::Int:
+            case QMetaType::UInt:
+            case QMetaType::LongLong:
+            case QMetaType::ULongLong:
+            case QMetaType::Double:
+            case QMetaType::Float:
+            case QMetaType::QString:
+            case QMetaType::QStringList:
+                return true;
+            case QMetaType::QVariantList:
+                for (const auto &item : value.toList())
+                {
+                    if (!isJsonSafe(item))
+                    {
+                        return false;
+                    }
+                }
+                return true;
+            case QMetaType::QVariantMap:
+                for (const auto &item : value.toMap())
+                {
+                    if (!isJsonSafe(item))
+                    {
+                        return false;
+                    }
+                }
+                return true;
+            default:
+                return false;
+            }
+        }
+
+        struct CompressionStats
+        {
+            qint64 results = 0;
+            qint64 rawBytes = 0;
+            qint64 sentBytes = 0;
+            qint64 nanoseconds = 0;
+        };
+
+        std::mutex compressionStatsMutex;
+        QHash<QString, CompressionStats> compressionStats;
+
+        void recordCompression(const QString &name, qsizetype rawBytes, qsizetype sentBytes, qint64 nanoseconds)
+        {
+            std::lock_guard<std::mutex> lock(compressionStatsMutex);
+            auto &stats = compressionStats[name];
+            ++stats.results;
+            stats.rawBytes += rawBytes;
+            stats.sentBytes += sentBytes;
+            stats.nanoseconds += nanoseconds;
+        }
+
+        // Per-member compression statistics, returned by call() for the
+        // reserved name "webflex:bridgeStats".
+        QVariantMap compressionStatsSnapshot()
+        {
+            std::lock_guard<std::mutex> lock(compressionStatsMutex);
+            QVariantMap snapshot;
+            for (auto it = compressionStats.cbegin(); it != compressionStats.cend(); ++it)
+            {
+                const auto &stats = it.value();
+                snapshot.insert(it.key(), QVariantMap{
+                    {"results", stats.results},
+                    {"rawBytes", stats.rawBytes},
+                    {"sentBytes", stats.sentBytes},
+                    {"ratio", stats.rawBytes > 0 ? double(stats.sentBytes) / double(stats.rawBytes) : 1.0},
+                    {"milliseconds", double(stats.nanoseconds) / 1e6}
+                });
+            }
+            return snapshot;
+        }
+
+        // Wraps every result of a member that opted into compression as
+        // { encoding, data }, so the page always knows to pass it through
+        // window.decodeResult(). Payloads at or above `threshold` are
+        // deflated; the rest travel as "identity". Only called from pool
+        // threads by callAsync(), never on the GUI thread.
+        QVariant compressResult(const QString &name, qsizetype threshold, QVariant result)
+        {
+            if (threshold < 0)
+            {
+                return result;
+            }
+
+            auto identity = [&result] {
+                return QVariantMap{{"encoding", QStringLiteral("identity")}, {"data", std::move(result)}};
+            };
+
+            QByteArray payload;
+            QString encoding;
+            if (result.typeId() == QMetaType::QString)
+            {
+                payload = result.toString().toUtf8();
+                encoding = "deflate-text";
+            }
+            else if ((result.typeId() == QMetaType::QVariantMap || result.typeId() == QMetaType::QVariantList) && isJsonSafe(result))
+            {
+                payload = QJsonDocument::fromVariant(result).toJson(QJsonDocument::Compact);
+                encoding = "deflate-json";
+            }
+
+            if (payload.isEmpty() || payload.size() < threshold)
+            {
+                return identity();
+            }
+
+            QElapsedTimer timer;
+            timer.start();
+            auto compressed = qCompress(payload, 1);
+            auto encodedSize = (compressed.size() + 2) / 3 * 4;
+
+            if (encodedSize >= payload.size())
+            {
+                return identity();
+            }
+
+            QVariantMap envelope{{"encoding", encoding}, {"data", QString::fromLatin1(compressed.toBase64())}};
+            recordCompression(name, payload.size(), encodedSize, timer.nsecsElapsed());
+            return envelope;
+        }
+    }
+
     JsAccessibleImpl::JsAccessibleImpl(QObject *parent) : QObject(parent)
     {
         m_pool.setMaxThreadCount(qMax(webflex::Application::threadCount(), 4u));
@@ -18,8 +317,8 @@ namespace webflex::impl
             auto returnIt = m_return_members.find(name);
             if (returnIt != m_return_members.end())
             {
-                m_pool.start([this, name, returnIt, arguments = std::move(arguments)]{ 
-                    asyncCallCompleted(name, webflex::utils::fromStdVariantToQvariant(returnIt->second.second(std::move(arguments)))); 
+                m_pool.start([this, name, returnIt, threshold = compressThreshold(*this, name), arguments = std::move(arguments)]{ 
+                    asyncCallCompleted(name, compressResult(name, threshold, webflex::utils::fromStdVariantToQvariant(returnIt->second.second(std::move(arguments))))); 
                 });
                 return;
             }
@@ -41,27 +340,46 @@ namespace webflex::impl
     QVariant JsAccessibleImpl::call(const QString &name, const QVariantList &args)
     {
         auto arguments = prepareArguments(args);
+        std::function<QVariant()> function;
 
+        // Copy the bound function out so a member that calls back into the
+        // bridge does not deadlock on the member mutex.
         {
             std::lock_guard<std::mutex> lock(m_return_members_mutex);
             auto returnIt = m_return_members.find(name);
             if (returnIt != m_return_members.end())
             {
-                return webflex::utils::fromStdVariantToQvariant(returnIt->second.second(std::move(arguments)));
+                function = [member = returnIt->second.second, arguments = std::move(arguments)]() mutable {
+                    return webflex::utils::fromStdVariantToQvariant(member(std::move(arguments)));
+                };
             }
         }
 
+        if (!function)
         {
             std::lock_guard<std::mutex> lock(m_no_return_members_mutex);
             auto noReturnIt = m_no_return_members.find(name);
             if (noReturnIt != m_no_return_members.end())
             {
-                noReturnIt->second.second(std::move(arguments));
-                return {};
+                function = [member = noReturnIt->second.second, arguments = std::move(arguments)]() mutable {
+                    member(std::move(arguments));
+                    return QVariant{};
+                };
             }
         }
 
-        return {};
+        if (!function)
+        {
+            return name == QLatin1String("webflex:bridgeStats") ? QVariant(compressionStatsSnapshot()) : QVariant{};
+        }
+
+        if (QThread::currentThread() != thread())
+        {
+            return function();
+        }
+
+        GuiWatchdogScope scope(name, callBudget(*this));
+        return function();
     }
 
     JsArguments JsAccessibleImpl::prepareArguments(const QVariantList &args)
@@ -75,4 +393,4 @@ namespace webflex::impl
     }
 
     W_OBJECT_IMPL(JsAccessibleImpl)
-}
\ No newline at end of file
+}
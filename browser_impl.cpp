@@ -262,6 +262,39 @@ namespace webflex::impl {
                     window.qchannel = channel;
                     window.invoker = channel.objects.invoker;
                 });
+
+                // Unpacks callAsync() results of members listed in the bridge's
+                // webflexCompressMembers property; anything else is returned as is.
+                window.decodeResult = async (value) => {
+                    if (!value || typeof value !== 'object' || typeof value.encoding !== 'string' || !('data' in value)) {
+                        return value;
+                    }
+
+                    if (value.encoding === 'identity') {
+                        return value.data;
+                    }
+
+                    // qCompress prefixes the zlib stream with a 4-byte length.
+                    let header = 4;
+                    const skipHeader = new TransformStream({
+                        transform(chunk, controller) {
+                            if (header > 0) {
+                                const skipped = Math.min(header, chunk.length);
+                                header -= skipped;
+                                chunk = chunk.subarray(skipped);
+                            }
+                            if (chunk.length) {
+                                controller.enqueue(chunk);
+                            }
+                        }
+                    });
+
+                    const response = await fetch('data:application/octet-stream;base64,' + value.data);
+                    const stream = response.body.pipeThrough(skipHeader).pipeThrough(new DecompressionStream('deflate'));
+                    const text = await new Response(stream).text();
+
+                    return value.encoding === 'deflate-json' ? JSON.parse(text) : text;
+                };
             })();
         )js"));
         scriptChannel.setInjectionPoint(QWebEngineScript::DocumentReady);